@@ -0,0 +1,84 @@
+# cmake/Findzstd.cmake
+
+#[=======================================================================[.rst:
+Findzstd
+----------
+
+Find the Zstandard compression library.
+
+IMPORTED Targets
+^^^^^^^^^^^^^^^^
+
+The following :prop_tgt:`IMPORTED` targets may be defined
+
+``zstd::zstd``
+  If the Zstandard library has been found
+
+Result variables
+^^^^^^^^^^^^^^^^
+
+This module will set the following variables in your project:
+
+``zstd_FOUND``
+  true if Zstandard headers and libraries were found
+
+Cache variables
+^^^^^^^^^^^^^^^
+
+Control variables
+^^^^^^^^^^^^^^^^^
+
+#]=======================================================================]
+
+# Try the original cmake package first
+find_package(zstd QUIET CONFIG)
+if(zstd_FOUND)
+    if(NOT TARGET zstd::zstd)
+        add_library(zstd::zstd INTERFACE IMPORTED)
+        if(TARGET zstd::libzstd_shared)
+            set_property(TARGET zstd::zstd PROPERTY
+                INTERFACE_LINK_LIBRARIES zstd::libzstd_shared)
+        else()
+            set_property(TARGET zstd::zstd PROPERTY
+                INTERFACE_LINK_LIBRARIES zstd::libzstd_static)
+        endif()
+    endif()
+    message(STATUS "Found zstd via cmake")
+    return()
+endif()
+
+# Then try pkg-config
+find_package(PkgConfig QUIET)
+if(PKG_CONFIG_FOUND)
+    pkg_check_modules(_pc_zstd QUIET libzstd)
+endif()
+if(_pc_zstd_FOUND)
+    set(zstd_FOUND "${_pc_zstd_FOUND}")
+    add_library(zstd::zstd INTERFACE IMPORTED)
+    if(_pc_zstd_INCLUDE_DIRS)
+        set_property(TARGET zstd::zstd PROPERTY
+            INTERFACE_INCLUDE_DIRECTORIES "${_pc_zstd_INCLUDE_DIRS}")
+    endif()
+    if(_pc_zstd_LDFLAGS)
+        set_property(TARGET zstd::zstd PROPERTY
+            INTERFACE_LINK_LIBRARIES "${_pc_zstd_LDFLAGS}")
+    endif()
+    message(STATUS "Found zstd via pkg-config")
+    return()
+endif()
+
+# Fall-back to system directories
+find_path(zstd_INCLUDE_DIR NAMES zstd.h)
+find_library(zstd_LIBRARY NAMES zstd)
+
+include(FindPackageHandleStandardArgs)
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(zstd
+    REQUIRED_VARS zstd_LIBRARY zstd_INCLUDE_DIR)
+
+if (zstd_FOUND)
+    add_library(zstd::zstd INTERFACE IMPORTED)
+    set_property(TARGET zstd::zstd PROPERTY
+        INTERFACE_INCLUDE_DIRECTORIES "${zstd_INCLUDE_DIR}")
+    set_property(TARGET zstd::zstd PROPERTY
+        INTERFACE_LINK_LIBRARIES "${zstd_LIBRARY}")
+endif()